@@ -0,0 +1,343 @@
+/* Includes **************************************************************************************/
+
+#define _POSIX_C_SOURCE 199309L
+
+#include "Testie.h"
+
+#include <stdio.h>
+#include <time.h>
+
+
+/* Constants *************************************************************************************/
+
+#define BENCHMARK_OUTPUT_FILE_DEFAULT       "TestieBenchmark.json"
+
+#define BENCHMARK_REPETITIONS               5U
+
+#define BENCHMARK_ITERATIONS_ASSERT_PASS    20000000UL
+#define BENCHMARK_ITERATIONS_CASE_PASS      2000000UL
+#define BENCHMARK_ITERATIONS_ASSERT_FAIL    2000000UL
+#define BENCHMARK_ITERATIONS_OUTPUT         200000UL
+
+#define BENCHMARK_OUTPUT_TEXT               "The quick brown fox jumps over the lazy dog. " \
+                                            "The quick brown fox jumps over the lazy dog. " \
+                                            "The quick brown fox jumps over the lazy dog. " \
+                                            "The quick brown fox jumps over the lazy dog."  \
+                                            TESTIE_OUTPUT_END_LINE
+
+
+/* Type definitions ******************************************************************************/
+
+// Single benchmark description
+typedef struct
+{
+    const char * pcName;
+    void (*Run)(unsigned long ulIterations);
+    unsigned long ulIterations;
+} S_BENCHMARK;
+
+// Single benchmark result
+typedef struct
+{
+    double dNanosecondsPerOperation;
+    double dBytesPerOperation;
+    double dMegabytesPerSecond;
+} S_BENCHMARK_RESULT;
+
+
+/* Global variables ******************************************************************************/
+
+static volatile unsigned long ulBenchmarkOutputBytes;
+static volatile unsigned long ulBenchmarkOutputChecksum;
+
+
+/* Private functions *****************************************************************************/
+
+/**************************************************************************************************
+* Desc  : Read the monotonic clock
+*
+* Output: Returns the current time in nanoseconds
+**************************************************************************************************/
+static double Benchmark_Now(void)
+{
+    struct timespec sTime;
+
+    clock_gettime(CLOCK_MONOTONIC, &sTime);
+
+    return (double) sTime.tv_sec * 1e9 + (double) sTime.tv_nsec;
+}
+
+
+/**************************************************************************************************
+* Desc  : Empty setup and tear down so only the framework overhead is measured
+**************************************************************************************************/
+static void Benchmark_Empty(void)
+{
+}
+
+
+/**************************************************************************************************
+* Desc  : Test case with a single passing assertion
+**************************************************************************************************/
+static TEST(Benchmark_PassingCase)
+{
+    ASSERT_EQUAL_UINT32(1U, 1U);
+}
+
+
+/**************************************************************************************************
+* Desc  : Passing number assertions, the most frequent call in a healthy test run
+*
+* Input : ulIterations is the amount of assertions
+**************************************************************************************************/
+static void Benchmark_AssertPass(unsigned long ulIterations)
+{
+    unsigned long ulIndex;
+
+    for (ulIndex = 0UL; ulIndex < ulIterations; ulIndex++)
+        Testie_AssertNumber((TESTIE_UINT32) ulIndex, (TESTIE_UINT32) ulIndex, 0U);
+}
+
+
+/**************************************************************************************************
+* Desc  : Passing test cases including the name and result line
+*
+* Input : ulIterations is the amount of test cases
+**************************************************************************************************/
+static void Benchmark_CasePass(unsigned long ulIterations)
+{
+    unsigned long ulIndex;
+
+    for (ulIndex = 0UL; ulIndex < ulIterations; ulIndex++)
+        TEST_RUN(Benchmark_PassingCase);
+}
+
+
+#if (TESTIE_TIMEOUT_ENABLE == 1U)
+/**************************************************************************************************
+* Desc  : Passing test cases with a time budget, so every case arms and disarms the watchdog
+*
+* Input : ulIterations is the amount of test cases
+**************************************************************************************************/
+static void Benchmark_CasePassGuarded(unsigned long ulIterations)
+{
+    unsigned long ulIndex;
+
+    TEST_TIMEOUT(1000U);
+
+    for (ulIndex = 0UL; ulIndex < ulIterations; ulIndex++)
+        TEST_RUN(Benchmark_PassingCase);
+
+    // The loop runs outside a test suite, so release the watchdog like the end of a suite does
+    TEST_TIMEOUT(0U);
+    TESTIE_WATCHDOG_RELEASE();
+}
+#endif
+
+
+/**************************************************************************************************
+* Desc  : Failing decimal number assertions, dominated by the number formatting
+*
+* Input : ulIterations is the amount of assertions
+**************************************************************************************************/
+static void Benchmark_AssertFailNumber(unsigned long ulIterations)
+{
+    unsigned long ulIndex;
+
+    for (ulIndex = 0UL; ulIndex < ulIterations; ulIndex++)
+    {
+        Testie.Case.CurrentFails = 1U;
+        Testie_AssertNumber(4000000000U - (TESTIE_UINT32) ulIndex, (TESTIE_UINT32) ulIndex, 0U);
+    }
+}
+
+
+/**************************************************************************************************
+* Desc  : Failing signed number assertions
+*
+* Input : ulIterations is the amount of assertions
+**************************************************************************************************/
+static void Benchmark_AssertFailSignedNumber(unsigned long ulIterations)
+{
+    unsigned long ulIndex;
+
+    for (ulIndex = 0UL; ulIndex < ulIterations; ulIndex++)
+    {
+        Testie.Case.CurrentFails = 1U;
+        Testie_AssertSignedNumber(-2000000000 + (TESTIE_INT32) (ulIndex & 0xFFFFUL), (TESTIE_INT32) ulIndex);
+    }
+}
+
+
+/**************************************************************************************************
+* Desc  : Failing hexadecimal number assertions
+*
+* Input : ulIterations is the amount of assertions
+**************************************************************************************************/
+static void Benchmark_AssertFailHex(unsigned long ulIterations)
+{
+    unsigned long ulIndex;
+
+    for (ulIndex = 0UL; ulIndex < ulIterations; ulIndex++)
+    {
+        Testie.Case.CurrentFails = 1U;
+        Testie_AssertNumber(0xDEAD0000U | (TESTIE_UINT32) (ulIndex & 0xFFFFUL), (TESTIE_UINT32) ulIndex, 1U);
+    }
+}
+
+
+#if (TESTIE_64BIT_ENABLE == 1U)
+/**************************************************************************************************
+* Desc  : Failing 64-bit number assertions
+*
+* Input : ulIterations is the amount of assertions
+**************************************************************************************************/
+static void Benchmark_AssertFailNumber64(unsigned long ulIterations)
+{
+    unsigned long ulIndex;
+
+    for (ulIndex = 0UL; ulIndex < ulIterations; ulIndex++)
+    {
+        Testie.Case.CurrentFails = 1U;
+        Testie_AssertSignedNumber64(-9000000000000000000LL + (TESTIE_INT64) ulIndex, (TESTIE_INT64) ulIndex * 1000000007LL);
+    }
+}
+#endif
+
+
+/**************************************************************************************************
+* Desc  : Raw output throughput through a failing assertion with a long message
+*
+* Input : ulIterations is the amount of messages
+**************************************************************************************************/
+static void Benchmark_Output(unsigned long ulIterations)
+{
+    unsigned long ulIndex;
+
+    for (ulIndex = 0UL; ulIndex < ulIterations; ulIndex++)
+    {
+        Testie.Case.CurrentFails = 1U;
+        Testie_Assert(0U, BENCHMARK_OUTPUT_TEXT);
+    }
+}
+
+
+/**************************************************************************************************
+* Desc  : Execute a benchmark and keep the fastest repetition
+*
+* Input : psBenchmark is the benchmark to execute
+* Output: Returns the benchmark result
+**************************************************************************************************/
+static S_BENCHMARK_RESULT Benchmark_Run(const S_BENCHMARK * psBenchmark)
+{
+    S_BENCHMARK_RESULT sResult;
+    unsigned int uiRepetition;
+    double dBest = 0.0;
+    unsigned long ulBytes = 0UL;
+
+    for (uiRepetition = 0U; uiRepetition < BENCHMARK_REPETITIONS; uiRepetition++)
+    {
+        double dStart;
+        double dElapsed;
+
+        Testie.Case.Setup         = Benchmark_Empty;
+        Testie.Case.TearDown      = Benchmark_Empty;
+        Testie.Case.CurrentFails  = 0U;
+        Testie.Case.CurrentPasses = 0U;
+        ulBenchmarkOutputBytes    = 0UL;
+
+        dStart = Benchmark_Now();
+        psBenchmark->Run(psBenchmark->ulIterations);
+        dElapsed = Benchmark_Now() - dStart;
+
+        if (uiRepetition == 0U || dElapsed < dBest)
+            dBest = dElapsed;
+        ulBytes = ulBenchmarkOutputBytes;
+    }
+
+    sResult.dNanosecondsPerOperation = dBest / (double) psBenchmark->ulIterations;
+    sResult.dBytesPerOperation       = (double) ulBytes / (double) psBenchmark->ulIterations;
+    sResult.dMegabytesPerSecond      = (dBest > 0.0) ? ((double) ulBytes * 1e3 / dBest) : 0.0;
+
+    return sResult;
+}
+
+
+/* Public functions ******************************************************************************/
+
+/**************************************************************************************************
+* Desc  : Output sink used by Testie while benchmarking, counts the emitted bytes
+*
+* Input : iCharacter is the character Testie wants to output
+**************************************************************************************************/
+void TestieBenchmark_OutputChar(int iCharacter)
+{
+    ulBenchmarkOutputBytes++;
+    ulBenchmarkOutputChecksum += (unsigned char) iCharacter;
+}
+
+
+/**************************************************************************************************
+* Desc  : Run all benchmarks and write the results as JSON
+*
+* Input : argv[1] is an optional path for the result file
+* Output: Returns 0 on success else 1
+**************************************************************************************************/
+int main(int argc, char * argv[])
+{
+    static const S_BENCHMARK asBenchmarks[] =
+    {
+        { "assert_pass",               Benchmark_AssertPass,             BENCHMARK_ITERATIONS_ASSERT_PASS },
+        { "case_pass",                 Benchmark_CasePass,               BENCHMARK_ITERATIONS_CASE_PASS   },
+#if (TESTIE_TIMEOUT_ENABLE == 1U)
+        { "case_pass_guarded",         Benchmark_CasePassGuarded,        BENCHMARK_ITERATIONS_CASE_PASS   },
+#endif
+        { "assert_fail_number",        Benchmark_AssertFailNumber,       BENCHMARK_ITERATIONS_ASSERT_FAIL },
+        { "assert_fail_signed_number", Benchmark_AssertFailSignedNumber, BENCHMARK_ITERATIONS_ASSERT_FAIL },
+        { "assert_fail_hex",           Benchmark_AssertFailHex,          BENCHMARK_ITERATIONS_ASSERT_FAIL },
+#if (TESTIE_64BIT_ENABLE == 1U)
+        { "assert_fail_number64",      Benchmark_AssertFailNumber64,     BENCHMARK_ITERATIONS_ASSERT_FAIL },
+#endif
+        { "output",                    Benchmark_Output,                 BENCHMARK_ITERATIONS_OUTPUT      },
+    };
+    const char * pcFileName = (argc > 1) ? argv[1] : BENCHMARK_OUTPUT_FILE_DEFAULT;
+    FILE * pFile;
+    size_t uIndex;
+
+    pFile = fopen(pcFileName, "w");
+    if (pFile == NULL)
+    {
+        fprintf(stderr, "Unable to open %s\n", pcFileName);
+        return 1;
+    }
+
+    // The configuration changes the results and the set of benchmarks, so it is stored with them
+    fprintf(pFile, "{\n  \"integer_variable_width\": %u,\n", (unsigned int) TESTIE_INTEGER_VARIABLE_WIDTH);
+    fprintf(pFile, "  \"format_division_free\": %u,\n", (unsigned int) TESTIE_FORMAT_DIVISION_FREE);
+    fprintf(pFile, "  \"64bit_enable\": %u,\n", (unsigned int) TESTIE_64BIT_ENABLE);
+    fprintf(pFile, "  \"timeout_enable\": %u,\n", (unsigned int) TESTIE_TIMEOUT_ENABLE);
+    fprintf(pFile, "  \"benchmarks\": [\n");
+    printf("%-28s %12s %14s %14s %12s\n", "benchmark", "iterations", "ns/op", "bytes/op", "MB/s");
+
+    for (uIndex = 0U; uIndex < sizeof(asBenchmarks) / sizeof(asBenchmarks[0]); uIndex++)
+    {
+        const S_BENCHMARK * psBenchmark = &asBenchmarks[uIndex];
+        S_BENCHMARK_RESULT sResult = Benchmark_Run(psBenchmark);
+
+        printf("%-28s %12lu %14.2f %14.2f %12.2f\n", psBenchmark->pcName, psBenchmark->ulIterations,
+               sResult.dNanosecondsPerOperation, sResult.dBytesPerOperation, sResult.dMegabytesPerSecond);
+
+        fprintf(pFile, "    { \"name\": \"%s\", \"iterations\": %lu, \"ns_per_op\": %.3f, \"bytes_per_op\": %.3f, \"mb_per_s\": %.3f }%s\n",
+                psBenchmark->pcName, psBenchmark->ulIterations, sResult.dNanosecondsPerOperation,
+                sResult.dBytesPerOperation, sResult.dMegabytesPerSecond,
+                (uIndex + 1U < sizeof(asBenchmarks) / sizeof(asBenchmarks[0])) ? "," : "");
+    }
+
+    fprintf(pFile, "  ]\n}\n");
+    fclose(pFile);
+
+    return 0;
+}
+
+
+/* End of module *********************************************************************************/
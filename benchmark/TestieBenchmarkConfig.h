@@ -0,0 +1,22 @@
+#ifndef _TESTIE_BENCHMARK_CONFIG_
+#define _TESTIE_BENCHMARK_CONFIG_
+
+/* Output settings *******************************************************************************/
+
+// Route every output character to a counting sink instead of the terminal
+#define TESTIE_OUTPUT_CHAR_INCLUDE          "TestieBenchmarkConfig.h"
+#define TESTIE_OUTPUT_CHAR                  TestieBenchmark_OutputChar
+
+
+/* Public functions ******************************************************************************/
+
+/**************************************************************************************************
+* Desc  : Output sink used by Testie while benchmarking, counts the emitted bytes
+*
+* Input : iCharacter is the character Testie wants to output
+**************************************************************************************************/
+void TestieBenchmark_OutputChar(int iCharacter);
+
+
+/* End of module *********************************************************************************/
+#endif
@@ -0,0 +1,298 @@
+/* Includes **************************************************************************************/
+
+#if defined(__linux__) && !defined(_XOPEN_SOURCE)
+#define _XOPEN_SOURCE 700
+#endif
+
+#include "Testie.h"
+
+#if defined(TESTIE_WATCHDOG_POSIX)
+#include <time.h>
+#endif
+
+
+/* Constants *************************************************************************************/
+
+#define EXAMPLE_SLEEP_MS                    100U
+#define EXAMPLE_SUITE_DURATION_MAX_MS       1000U
+
+
+/* Global variables ******************************************************************************/
+
+static TESTIE_UINT8 aui8Buffer[4];
+static TESTIE_UINT8 ui8TearDownCount;
+static TESTIE_UINT8 ui8NotRunCount;
+static TESTIE_UINT32 ui32SleptMs;
+
+
+/* Private functions *****************************************************************************/
+
+/**************************************************************************************************
+* Desc  : Executed before every test case
+**************************************************************************************************/
+static void Example_Setup(void)
+{
+    aui8Buffer[0] = 0xDEU;
+    aui8Buffer[1] = 0xADU;
+    aui8Buffer[2] = 0xBEU;
+    aui8Buffer[3] = 0xEFU;
+}
+
+
+/**************************************************************************************************
+* Desc  : Executed after every test case
+**************************************************************************************************/
+static void Example_TearDown(void)
+{
+    ui8TearDownCount++;
+}
+
+
+#if (TESTIE_TIMEOUT_ENABLE == 1U)
+/**************************************************************************************************
+* Desc  : Setup that never returns
+**************************************************************************************************/
+static void Example_HangingSetup(void)
+{
+    for (;;)
+    {
+    }
+}
+#endif
+
+
+#if defined(TESTIE_WATCHDOG_POSIX)
+/**************************************************************************************************
+* Desc  : Sleep and record how long the sleep took, a watchdog signal would cut it short
+**************************************************************************************************/
+static void Example_Sleep(void)
+{
+    struct timespec sTime = { 0, EXAMPLE_SLEEP_MS * 1000000L };
+    TESTIE_UINT32 ui32Start = TESTIE_TIME_MS();
+
+    nanosleep(&sTime, NULL);
+    ui32SleptMs = TESTIE_TIME_MS() - ui32Start;
+}
+
+
+/**************************************************************************************************
+* Desc  : Tear down that sleeps after a guarded test case
+**************************************************************************************************/
+static void Example_SleepingTearDown(void)
+{
+    Example_Sleep();
+}
+#endif
+
+
+/* Test cases ************************************************************************************/
+
+TEST(Example_Booleans)
+{
+    ASSERT_TRUE(1U == 1U);
+    ASSERT_FALSE(1U == 0U);
+}
+
+
+TEST(Example_Numbers)
+{
+    ASSERT_EQUAL_INT8(-1, -1);
+    ASSERT_EQUAL_INT32(-100000, -100000);
+    ASSERT_EQUAL_UINT16(65535U, 65535U);
+    ASSERT_EQUAL_UINT32(4000000000U, 4000000000U);
+    ASSERT_EQUAL_HEX(0xDEADBEEFU, 0xDEADBEEFU);
+#if (TESTIE_64BIT_ENABLE == 1U)
+    ASSERT_EQUAL_INT64(-9000000000LL, -9000000000LL);
+    ASSERT_EQUAL_UINT64(18000000000000000000ULL, 18000000000000000000ULL);
+    ASSERT_EQUAL_HEX64(0x0123456789ABCDEFULL, 0x0123456789ABCDEFULL);
+#endif
+}
+
+
+TEST(Example_Strings)
+{
+    TESTIE_CHAR acActual[] = "Testie";
+
+    ASSERT_EQUAL_STRING("Testie", acActual);
+    ASSERT_EQUAL_STRING_ROM("Testie", acActual);
+}
+
+
+TEST(Example_Memory)
+{
+    static TESTIE_ROM const TESTIE_UINT8 aui8Expected[] = { 0xDEU, 0xADU, 0xBEU, 0xEFU };
+
+    ASSERT_EQUAL_MEMORY(aui8Expected, aui8Buffer, sizeof(aui8Buffer));
+    ASSERT_EQUAL_MEMORY_ROM(aui8Expected, aui8Buffer, sizeof(aui8Buffer));
+}
+
+
+#if (TESTIE_TIMEOUT_ENABLE == 1U)
+TEST(Example_Hang)
+{
+    ASSERT_TRUE(1U);
+
+    for (;;)
+    {
+    }
+}
+
+
+TEST(Example_AfterTimeout)
+{
+    ASSERT_EQUAL_UINT8(1U, Testie.Case.CountFailed);
+    ASSERT_EQUAL_UINT8(1U, ui8TearDownCount);
+}
+
+
+TEST(Example_NotRun)
+{
+    ui8NotRunCount++;
+    ASSERT_TRUE(1U);
+}
+#endif
+
+
+#if defined(TESTIE_WATCHDOG_POSIX)
+TEST(Example_TearDownSlept)
+{
+    ASSERT_TRUE(ui32SleptMs >= EXAMPLE_SLEEP_MS);
+}
+
+
+TEST(Example_Slept)
+{
+    Example_Sleep();
+    ASSERT_TRUE(ui32SleptMs >= EXAMPLE_SLEEP_MS);
+}
+#endif
+
+
+/* Test suites ***********************************************************************************/
+
+TEST_SUITE(Example_Suite)
+{
+    Testie.Case.Setup    = Example_Setup;
+    Testie.Case.TearDown = Example_TearDown;
+
+    TEST_SUITE_TIMEOUT(1000U);
+    TEST_TIMEOUT(100U);
+
+    TEST_RUN(Example_Booleans);
+    TEST_RUN(Example_Numbers);
+    TEST_RUN(Example_Strings);
+    TEST_RUN(Example_Memory);
+}
+
+
+#if (TESTIE_TIMEOUT_ENABLE == 1U)
+TEST_SUITE(Example_TimeoutSuite)
+{
+    Testie.Case.Setup    = Example_Setup;
+    Testie.Case.TearDown = Example_TearDown;
+    ui8TearDownCount     = 0U;
+
+    TEST_TIMEOUT(50U);
+
+    TEST_RUN(Example_Hang);
+    TEST_RUN(Example_AfterTimeout);
+}
+
+
+TEST_SUITE(Example_SetupTimeoutSuite)
+{
+    Testie.Case.Setup    = Example_HangingSetup;
+    Testie.Case.TearDown = Example_TearDown;
+    ui8TearDownCount     = 0U;
+
+    TEST_TIMEOUT(50U);
+
+    TEST_RUN(Example_Booleans);
+
+    Testie.Case.Setup = Example_Setup;
+    TEST_RUN(Example_AfterTimeout);
+}
+
+
+TEST_SUITE(Example_SuiteTimeoutSuite)
+{
+    Testie.Case.Setup    = Example_Setup;
+    Testie.Case.TearDown = Example_TearDown;
+    ui8NotRunCount       = 0U;
+
+    // The case budget is clamped to the remaining suite budget, afterwards nothing runs anymore
+    TEST_SUITE_TIMEOUT(50U);
+    TEST_TIMEOUT(10000U);
+
+    TEST_RUN(Example_Hang);
+    TEST_RUN(Example_NotRun);
+}
+#endif
+
+
+#if defined(TESTIE_WATCHDOG_POSIX)
+TEST_SUITE(Example_TimerSuite)
+{
+    Testie.Case.Setup    = Example_Setup;
+    Testie.Case.TearDown = Example_SleepingTearDown;
+
+    // The watchdog timer may not fire into the tear down or a later unguarded test case
+    TEST_TIMEOUT(20U);
+    TEST_RUN(Example_Booleans);
+
+    Testie.Case.TearDown = Example_TearDown;
+    TEST_RUN(Example_TearDownSlept);
+
+    TEST_TIMEOUT(0U);
+    TEST_RUN(Example_Slept);
+}
+#endif
+
+
+/* Public functions ******************************************************************************/
+
+/**************************************************************************************************
+* Desc  : Run the example test suites
+*
+* Output: Returns 0 when all test cases gave the expected result else 1
+**************************************************************************************************/
+int main(void)
+{
+    int iResult = 0;
+#if (TESTIE_TIMEOUT_ENABLE == 1U)
+    TESTIE_UINT32 ui32Start;
+#endif
+
+    TEST_SUITE_RUN(Example_Suite);
+    if (Testie.Case.CountFailed != 0U)
+        iResult = 1;
+
+#if (TESTIE_TIMEOUT_ENABLE == 1U)
+    // The hanging test case is expected to be the only failure
+    TEST_SUITE_RUN(Example_TimeoutSuite);
+    if (Testie.Case.CountFailed != 1U)
+        iResult = 1;
+
+    // The hanging setup is expected to be the only failure
+    TEST_SUITE_RUN(Example_SetupTimeoutSuite);
+    if (Testie.Case.CountFailed != 1U)
+        iResult = 1;
+
+    // Both test cases fail, the second one without being executed
+    ui32Start = TESTIE_TIME_MS();
+    TEST_SUITE_RUN(Example_SuiteTimeoutSuite);
+    if (Testie.Case.CountFailed != 2U || ui8NotRunCount != 0U || TESTIE_TIME_MS() - ui32Start >= EXAMPLE_SUITE_DURATION_MAX_MS)
+        iResult = 1;
+#endif
+
+#if defined(TESTIE_WATCHDOG_POSIX)
+    TEST_SUITE_RUN(Example_TimerSuite);
+    if (Testie.Case.CountFailed != 0U)
+        iResult = 1;
+#endif
+
+    return iResult;
+}
+
+
+/* End of module *********************************************************************************/
@@ -1,15 +1,44 @@
 /* Includes **************************************************************************************/
 
+#if defined(__linux__) && !defined(_XOPEN_SOURCE)
+#define _XOPEN_SOURCE 700
+#endif
+
 #include "Testie.h"
+#include "TestieFormat.h"
 
 #include TESTIE_STRING_H_INCLUDE
 #include TESTIE_OUTPUT_CHAR_INCLUDE
 
+#if (TESTIE_TIMEOUT_ENABLE == 1U)
+#include <setjmp.h>
+
+#if defined(TESTIE_WATCHDOG_INCLUDE)
+#include TESTIE_WATCHDOG_INCLUDE
+#endif
+
+#if defined(__linux__)
+#include <signal.h>
+#include <sys/time.h>
+#include <time.h>
+#endif
+#endif
+
 
 /* Global variables ******************************************************************************/
 
 S_TESTIE Testie;
 
+#if (TESTIE_TIMEOUT_ENABLE == 1U)
+static jmp_buf TestieTimeoutJump;
+static volatile TESTIE_UINT8 ui8TestieTimeoutArmed;
+
+#if defined(TESTIE_WATCHDOG_POSIX)
+static struct sigaction sTestiePreviousAction;
+static TESTIE_UINT8 ui8TestieHandlerInstalled;
+#endif
+#endif
+
 
 /* Private functions *****************************************************************************/
 
@@ -109,122 +138,200 @@ void Testie_PrintFillLine(TESTIE_CHAR cFill)
 
 
 /**************************************************************************************************
-* Desc  : Print a number
+* Desc  : Print a test case name padded to the result column
 *
-* Input : ui32Number is a unsigned number
+* Input : pcName is a ROM string with the test case name
 **************************************************************************************************/
-void Testie_PrintNumber(TESTIE_UINT32 ui32Number)
+void Testie_PrintCaseName(TESTIE_ROM const TESTIE_CHAR * pcName)
 {
-    TESTIE_UINT32 ui32Divisor;
-    TESTIE_UINT32 ui32TempNumber = ui32Number;
-
-    if (ui32Number == 0)
+    if (TESTIE_STRING_LENGTH_ROM(pcName) < TESTIE_OUTPUT_CASE_NAME_WIDTH_MAX)
     {
-        TESTIE_OUTPUT_CHAR('0');
-        return;
+        Testie_PrintROMString(pcName);
+        Testie_PrintFill('.', TESTIE_OUTPUT_CASE_NAME_WIDTH_MAX - TESTIE_STRING_LENGTH_ROM(pcName));
     }
-
-    for (ui32Divisor = 1000000000U; ui32Divisor != 0U; ui32Divisor /= 10U)
+    else
     {
-        if (ui32Number >= ui32Divisor)
-        {
-            TESTIE_OUTPUT_CHAR('0' + (TESTIE_CHAR) (ui32TempNumber / ui32Divisor));
-            ui32TempNumber %= ui32Divisor;
-        }
+        Testie_PrintROMStringLeft(pcName, TESTIE_OUTPUT_CASE_NAME_WIDTH_MAX);
     }
+    TESTIE_OUTPUT_CHAR(' ');
 }
 
 
 /**************************************************************************************************
-* Desc  : Print a number that can be negative
+* Desc  : Print a memory array
 *
-* Input : i32Number is a signed number
+* Input : pui8Array is the memory array
+* Input : ui8Length is the memory  array length
 **************************************************************************************************/
-void Testie_PrintSignedNumber(TESTIE_INT32 i32Number)
+void Testie_PrintMemory(TESTIE_UINT8 * pui8Array, TESTIE_UINT8 ui8Length)
 {
-    if (i32Number < 0)
+    TESTIE_UINT8 ui8Index;
+
+    for (ui8Index = 0U; ui8Index < ui8Length; ui8Index++)
     {
-        TESTIE_OUTPUT_CHAR('-');
-        i32Number *= -1;
+        Testie_PrintHexNumber(pui8Array[ui8Index], 2U);
+        if (ui8Index != ui8Length - 1U)
+            TESTIE_OUTPUT_CHAR(' ');
     }
-    Testie_PrintNumber((TESTIE_UINT32) i32Number);
 }
 
 
 /**************************************************************************************************
-* Desc  : Print a hexadecimal ASCII character
+* Desc  : Print a ROM memory array
 *
-* Input : ui8HexValue is a hexadecimal value for the character
+* Input : pui8Array is the ROM memory array
+* Input : ui8Length is the ROM memory  array length
 **************************************************************************************************/
-void Testie_PrintHexCharacter(TESTIE_UINT8 ui8HexValue)
+void Testie_PrintROMMemory(TESTIE_ROM const TESTIE_UINT8 * pui8Array, TESTIE_UINT8 ui8Length)
 {
-    if (ui8HexValue >= 0x0A)
-    {
-        TESTIE_OUTPUT_CHAR(0x37 + ui8HexValue);
-    }
-    else
+    TESTIE_UINT8 ui8Index;
+
+    for (ui8Index = 0U; ui8Index < ui8Length; ui8Index++)
     {
-        TESTIE_OUTPUT_CHAR('0' + ui8HexValue);
+        Testie_PrintHexNumber(pui8Array[ui8Index], 2U);
+        if (ui8Index != ui8Length - 1U)
+            TESTIE_OUTPUT_CHAR(' ');
     }
 }
 
 
+#if (TESTIE_TIMEOUT_ENABLE == 1U)
+#if defined(__linux__)
 /**************************************************************************************************
-* Desc  : Print a hexadecimal number
+* Desc  : Read the monotonic clock
 *
-* Input : ui32HexNumber is a hexadecimal value
-* Input : ui8LengthMin is the minimum character length of the hexadecimal value
+* Output: Returns the time in milliseconds
 **************************************************************************************************/
-void Testie_PrintHexNumber(TESTIE_UINT32 ui32HexNumber, TESTIE_UINT8 ui8LengthMin)
+TESTIE_UINT32 Testie_PosixTimeMs(void)
 {
-    TESTIE_INT8 i8BitShift;
+    struct timespec sTime;
+
+    clock_gettime(CLOCK_MONOTONIC, &sTime);
 
-    for (i8BitShift = 28; i8BitShift >= 0; i8BitShift -= 4)
+    return (TESTIE_UINT32) sTime.tv_sec * 1000U + (TESTIE_UINT32) (sTime.tv_nsec / 1000000L);
+}
+#endif
+
+
+#if defined(TESTIE_WATCHDOG_POSIX)
+/**************************************************************************************************
+* Desc  : Watchdog signal handler
+*
+* Input : iSignal is the received signal
+**************************************************************************************************/
+void Testie_PosixWatchdogHandler(int iSignal)
+{
+    (void) iSignal;
+
+    Testie_Timeout();
+}
+
+
+/**************************************************************************************************
+* Desc  : Arm the watchdog timer, the signal handler is installed once for each test suite
+*
+* Input : ui32Milliseconds is the time budget
+**************************************************************************************************/
+void Testie_PosixWatchdogStart(TESTIE_UINT32 ui32Milliseconds)
+{
+    struct sigaction sAction;
+    struct itimerval sTimer;
+
+    if (ui8TestieHandlerInstalled == 0U)
     {
-        if (ui32HexNumber >= (TESTIE_UINT32) 1U << i8BitShift || ui8LengthMin > (TESTIE_UINT8) (i8BitShift / 4) )
-            Testie_PrintHexCharacter((ui32HexNumber >> i8BitShift) & 0x0F);
+        // The handler leaves through longjmp, so the signal may not stay blocked
+        memset(&sAction, 0, sizeof(sAction));
+        sAction.sa_handler = Testie_PosixWatchdogHandler;
+        sAction.sa_flags   = SA_NODEFER | SA_RESTART;
+        sigemptyset(&sAction.sa_mask);
+        sigaction(SIGALRM, &sAction, &sTestiePreviousAction);
+
+        ui8TestieHandlerInstalled = 1U;
     }
 
-    TESTIE_OUTPUT_CHAR('h');
+    memset(&sTimer, 0, sizeof(sTimer));
+    sTimer.it_value.tv_sec  = (time_t) (ui32Milliseconds / 1000U);
+    sTimer.it_value.tv_usec = (suseconds_t) (ui32Milliseconds % 1000U) * 1000;
+    setitimer(ITIMER_REAL, &sTimer, NULL);
 }
 
 
 /**************************************************************************************************
-* Desc  : Print a memory array
-*
-* Input : pui8Array is the memory array
-* Input : ui8Length is the memory  array length
+* Desc  : Disarm the watchdog timer, so no signal reaches the tear down or later test cases
 **************************************************************************************************/
-void Testie_PrintMemory(TESTIE_UINT8 * pui8Array, TESTIE_UINT8 ui8Length)
+void Testie_PosixWatchdogStop(void)
 {
-    TESTIE_UINT8 ui8Index;
+    struct itimerval sTimer;
 
-    for (ui8Index = 0U; ui8Index < ui8Length; ui8Index++)
+    memset(&sTimer, 0, sizeof(sTimer));
+    setitimer(ITIMER_REAL, &sTimer, NULL);
+}
+
+
+/**************************************************************************************************
+* Desc  : Stop the timer and restore the signal handler that was installed before the test suite
+**************************************************************************************************/
+void Testie_PosixWatchdogRelease(void)
+{
+    struct itimerval sTimer;
+
+    if (ui8TestieHandlerInstalled == 1U)
     {
-        Testie_PrintHexNumber(pui8Array[ui8Index], 2U);
-        if (ui8Index != ui8Length - 1U)
-            TESTIE_OUTPUT_CHAR(' ');
+        memset(&sTimer, 0, sizeof(sTimer));
+        setitimer(ITIMER_REAL, &sTimer, NULL);
+
+        sigaction(SIGALRM, &sTestiePreviousAction, NULL);
+        ui8TestieHandlerInstalled = 0U;
     }
 }
+#endif
 
 
 /**************************************************************************************************
-* Desc  : Print a ROM memory array
+* Desc  : Execute the test case setup and function guarded by the watchdog
 *
-* Input : pui8Array is the ROM memory array
-* Input : ui8Length is the ROM memory  array length
+* Input : Test is a function pointer for the test case
+* Input : ui32Budget is the time budget in milliseconds
+* Output: Returns 1 if the test case timed out else 0
 **************************************************************************************************/
-void Testie_PrintROMMemory(TESTIE_ROM const TESTIE_UINT8 * pui8Array, TESTIE_UINT8 ui8Length)
+TESTIE_UINT8 Testie_RunGuarded(void (*Test)(void), TESTIE_UINT32 ui32Budget)
 {
-    TESTIE_UINT8 ui8Index;
+    if (setjmp(TestieTimeoutJump) == 0)
+    {
+        ui8TestieTimeoutArmed = 1U;
+        TESTIE_WATCHDOG_START(ui32Budget);
 
-    for (ui8Index = 0U; ui8Index < ui8Length; ui8Index++)
+        Testie.Case.Setup();
+        Test();
+
+        ui8TestieTimeoutArmed = 0U;
+        TESTIE_WATCHDOG_STOP();
+        return 0U;
+    }
+
+    TESTIE_WATCHDOG_STOP();
+    return 1U;
+}
+
+
+/**************************************************************************************************
+* Desc  : Record a timeout for the current test case
+*
+* Input : pcReason is a ROM string with the timeout reason
+* Input : ui32Elapsed is the elapsed time in milliseconds
+**************************************************************************************************/
+void Testie_PrintTimeout(TESTIE_ROM const TESTIE_CHAR * pcReason, TESTIE_UINT32 ui32Elapsed)
+{
+    if (Testie.Case.CurrentFails++ == 0)
     {
-        Testie_PrintHexNumber(pui8Array[ui8Index], 2U);
-        if (ui8Index != ui8Length - 1U)
-            TESTIE_OUTPUT_CHAR(' ');
+        Testie_PrintROMString(TESTIE_OUTPUT_CASE_FAIL);
     }
+
+    Testie_PrintROMString(pcReason);
+    Testie_PrintNumber(ui32Elapsed, 0U);
+    Testie_PrintROMString(TESTIE_OUTPUT_MILLISECONDS);
 }
+#endif
 
 
 /* Public functions ******************************************************************************/
@@ -239,18 +346,28 @@ void Testie_RunTestSuite(void (*TestSuite)(void), TESTIE_ROM const TESTIE_CHAR *
 {
     Testie.Case.Count       = 0U;
     Testie.Case.CountFailed = 0U;
+    Testie.Case.Timeout     = TESTIE_TIMEOUT_CASE_DEFAULT;
+    Testie.Suite.Timeout    = TESTIE_TIMEOUT_SUITE_DEFAULT;
 
     Testie_PrintROMString(pcName);
     Testie_PrintROMString(TESTIE_OUTPUT_END_LINE);
     Testie_PrintFillLine(TESTIE_OUTPUT_FILL_CHARACTER);
 
+#if (TESTIE_TIMEOUT_ENABLE == 1U)
+    Testie.Suite.Start = TESTIE_TIME_MS();
+#endif
+
     TestSuite();
 
+#if (TESTIE_TIMEOUT_ENABLE == 1U)
+    TESTIE_WATCHDOG_RELEASE();
+#endif
+
     Testie_PrintFillLine(TESTIE_OUTPUT_FILL_CHARACTER);
 
-    Testie_PrintNumber(Testie.Case.Count);
+    Testie_PrintNumber(Testie.Case.Count, 0U);
     Testie_PrintROMString(TESTIE_OUTPUT_TEST_CASES);
-    Testie_PrintNumber(Testie.Case.CountFailed);
+    Testie_PrintNumber(Testie.Case.CountFailed, 0U);
     Testie_PrintROMString(TESTIE_OUTPUT_TEST_CASES_FAILED);
 }
 
@@ -263,24 +380,54 @@ void Testie_RunTestSuite(void (*TestSuite)(void), TESTIE_ROM const TESTIE_CHAR *
 **************************************************************************************************/
 void Testie_RunTestCase(void (*Test)(void), TESTIE_ROM const TESTIE_CHAR * pcName)
 {
+#if (TESTIE_TIMEOUT_ENABLE == 1U)
+    TESTIE_UINT32 ui32Budget = Testie.Case.Timeout;
+    TESTIE_UINT32 ui32Elapsed;
+    TESTIE_UINT32 ui32Start;
+#endif
+
     Testie.Case.Count++;
     Testie.Case.CurrentFails  = 0U;
     Testie.Case.CurrentPasses = 0U;
 
-    Testie.Case.Setup();
+#if (TESTIE_TIMEOUT_ENABLE == 1U)
+    if (Testie.Suite.Timeout != 0U)
+    {
+        ui32Elapsed = TESTIE_TIME_MS() - Testie.Suite.Start;
 
-    if (TESTIE_STRING_LENGTH_ROM(pcName) < TESTIE_OUTPUT_CASE_NAME_WIDTH_MAX)
+        // The test suite budget is spent, the remaining test cases fail without being executed
+        if (ui32Elapsed >= Testie.Suite.Timeout)
+        {
+            Testie_PrintCaseName(pcName);
+            Testie_PrintTimeout(TESTIE_OUTPUT_SUITE_TIMEOUT, ui32Elapsed);
+            Testie.Case.CountFailed++;
+            return;
+        }
+
+        if (ui32Budget == 0U || Testie.Suite.Timeout - ui32Elapsed < ui32Budget)
+            ui32Budget = Testie.Suite.Timeout - ui32Elapsed;
+    }
+#endif
+
+    Testie_PrintCaseName(pcName);
+
+#if (TESTIE_TIMEOUT_ENABLE == 1U)
+    if (ui32Budget != 0U)
     {
-        Testie_PrintROMString(pcName);
-        Testie_PrintFill('.', TESTIE_OUTPUT_CASE_NAME_WIDTH_MAX - TESTIE_STRING_LENGTH_ROM(pcName));
+        ui32Start = TESTIE_TIME_MS();
+
+        if (Testie_RunGuarded(Test, ui32Budget) == 1U)
+            Testie_PrintTimeout(TESTIE_OUTPUT_CASE_TIMEOUT, TESTIE_TIME_MS() - ui32Start);
     }
     else
     {
-        Testie_PrintROMStringLeft(pcName, TESTIE_OUTPUT_CASE_NAME_WIDTH_MAX);
+        Testie.Case.Setup();
+        Test();
     }
-    TESTIE_OUTPUT_CHAR(' ');
-
+#else
+    Testie.Case.Setup();
     Test();
+#endif
 
     if (Testie.Case.CurrentPasses >= 1U && Testie.Case.CurrentFails == 0U)
     {
@@ -346,7 +493,7 @@ void Testie_AssertNumber(TESTIE_UINT32 ui32Expected, TESTIE_UINT32 ui32Actual, T
         }
         else
         {
-            Testie_PrintNumber(ui32Expected);
+            Testie_PrintNumber(ui32Expected, 0U);
         }
 
 
@@ -357,7 +504,7 @@ void Testie_AssertNumber(TESTIE_UINT32 ui32Expected, TESTIE_UINT32 ui32Actual, T
         }
         else
         {
-            Testie_PrintNumber(ui32Actual);
+            Testie_PrintNumber(ui32Actual, 0U);
         }
 
         Testie_PrintROMString(TESTIE_OUTPUT_END_LINE);
@@ -385,12 +532,87 @@ void Testie_AssertSignedNumber(TESTIE_INT32 i32Expected, TESTIE_INT32 i32Actual)
         }
 
         Testie_PrintROMString(TESTIE_OUTPUT_EXPECTED);
-        Testie_PrintSignedNumber(i32Expected);
+        Testie_PrintSignedNumber(i32Expected, 0U);
+        Testie_PrintROMString(TESTIE_OUTPUT_WAS);
+        Testie_PrintSignedNumber(i32Actual, 0U);
+        Testie_PrintROMString(TESTIE_OUTPUT_END_LINE);
+    }
+}
+
+
+#if (TESTIE_64BIT_ENABLE == 1U)
+/**************************************************************************************************
+* Desc  : Test if two 64-bit numbers are equal
+*
+* Input : ui64Expected is the expected number
+* Input : ui64Actual is the actual number
+* Input : ui8IsHex is 1 if expected and actual are hexadecimal else 0
+**************************************************************************************************/
+void Testie_AssertNumber64(TESTIE_UINT64 ui64Expected, TESTIE_UINT64 ui64Actual, TESTIE_UINT8 ui8IsHex)
+{
+    if (ui64Expected == ui64Actual)
+    {
+        Testie.Case.CurrentPasses++;
+    }
+    else
+    {
+        if (Testie.Case.CurrentFails++ == 0)
+        {
+            Testie_PrintROMString(TESTIE_OUTPUT_CASE_FAIL);
+        }
+
+        Testie_PrintROMString(TESTIE_OUTPUT_EXPECTED);
+        if (ui8IsHex == 1U)
+        {
+            Testie_PrintHexNumber64(ui64Expected, 1U);
+        }
+        else
+        {
+            Testie_PrintNumber64(ui64Expected, 0U);
+        }
+
+        Testie_PrintROMString(TESTIE_OUTPUT_WAS);
+        if (ui8IsHex == 1U)
+        {
+            Testie_PrintHexNumber64(ui64Actual, 1U);
+        }
+        else
+        {
+            Testie_PrintNumber64(ui64Actual, 0U);
+        }
+
+        Testie_PrintROMString(TESTIE_OUTPUT_END_LINE);
+    }
+}
+
+
+/**************************************************************************************************
+* Desc  : Test if two signed 64-bit numbers are equal
+*
+* Input : i64Expected is the expected number
+* Input : i64Actual is the actual number
+**************************************************************************************************/
+void Testie_AssertSignedNumber64(TESTIE_INT64 i64Expected, TESTIE_INT64 i64Actual)
+{
+    if (i64Expected == i64Actual)
+    {
+        Testie.Case.CurrentPasses++;
+    }
+    else
+    {
+        if (Testie.Case.CurrentFails++ == 0)
+        {
+            Testie_PrintROMString(TESTIE_OUTPUT_CASE_FAIL);
+        }
+
+        Testie_PrintROMString(TESTIE_OUTPUT_EXPECTED);
+        Testie_PrintSignedNumber64(i64Expected, 0U);
         Testie_PrintROMString(TESTIE_OUTPUT_WAS);
-        Testie_PrintSignedNumber(i32Actual);
+        Testie_PrintSignedNumber64(i64Actual, 0U);
         Testie_PrintROMString(TESTIE_OUTPUT_END_LINE);
     }
 }
+#endif
 
 
 /**************************************************************************************************
@@ -465,4 +687,37 @@ void Testie_AssertMemory(void * pExpected, TESTIE_UINT8 * pui8Actual, TESTIE_UIN
 }
 
 
+#if (TESTIE_TIMEOUT_ENABLE == 1U)
+/**************************************************************************************************
+* Desc  : Abort the running test case when its time budget expired, called by the watchdog
+*         interrupt or signal handler. Without TESTIE_WATCHDOG_RECOVER this function does not
+*         return, so it may only be called where longjmp out of the handler is valid.
+**************************************************************************************************/
+void Testie_Timeout(void)
+{
+    if (ui8TestieTimeoutArmed == 1U)
+    {
+        ui8TestieTimeoutArmed = 0U;
+
+#if defined(TESTIE_WATCHDOG_RECOVER)
+        // Leave the exception context first, the interrupt returns into Testie_TimeoutRecover()
+        TESTIE_WATCHDOG_RECOVER(Testie_TimeoutRecover);
+#else
+        longjmp(TestieTimeoutJump, 1);
+#endif
+    }
+}
+
+
+/**************************************************************************************************
+* Desc  : Resume point for TESTIE_WATCHDOG_RECOVER, jumps back to the test case runner once the
+*         watchdog interrupt has returned
+**************************************************************************************************/
+void Testie_TimeoutRecover(void)
+{
+    longjmp(TestieTimeoutJump, 1);
+}
+#endif
+
+
 /* End of module *********************************************************************************/
@@ -16,6 +16,11 @@
 #define TEST_SUITE_DECLARATION(Name)                        extern void (Name)(void)
 #define TEST_SUITE_RUN(Name)                                Testie_RunTestSuite((Name), #Name" "TESTIE_OUTPUT_SUITE)
 
+// Time budgets are reset when a test suite starts, so they have to be set inside the suite body.
+// The case budget covers the setup and the test case, the tear down is not guarded.
+#define TEST_TIMEOUT(Milliseconds)                          (Testie.Case.Timeout = (TESTIE_UINT32) (Milliseconds))
+#define TEST_SUITE_TIMEOUT(Milliseconds)                    (Testie.Suite.Timeout = (TESTIE_UINT32) (Milliseconds))
+
 
 /* Assertion declarations ************************************************************************/
 
@@ -27,14 +32,17 @@
 #define ASSERT_EQUAL_INT8(Expected, Actual)                 Testie_AssertSignedNumber((TESTIE_INT8) (Expected), (TESTIE_INT8) (Actual))
 #define ASSERT_EQUAL_INT16(Expected, Actual)                Testie_AssertSignedNumber((TESTIE_INT16) (Expected), (TESTIE_INT16) (Actual))
 #define ASSERT_EQUAL_INT32(Expected, Actual)                Testie_AssertSignedNumber((TESTIE_INT32) (Expected), (TESTIE_INT32) (Actual))
+#define ASSERT_EQUAL_INT64(Expected, Actual)                Testie_AssertSignedNumber64((TESTIE_INT64) (Expected), (TESTIE_INT64) (Actual))
 #define ASSERT_EQUAL_INT(Expected, Actual)                  ASSERT_EQUAL_INT32((Expected), (Actual))
 
 #define ASSERT_EQUAL_UINT8(Expected, Actual)                Testie_AssertNumber((TESTIE_UINT8) (Expected), (TESTIE_UINT8) (Actual), 0U)
 #define ASSERT_EQUAL_UINT16(Expected, Actual)               Testie_AssertNumber((TESTIE_UINT16) (Expected), (TESTIE_UINT16) (Actual), 0U)
 #define ASSERT_EQUAL_UINT32(Expected, Actual)               Testie_AssertNumber((TESTIE_UINT32) (Expected), (TESTIE_UINT32) (Actual), 0U)
+#define ASSERT_EQUAL_UINT64(Expected, Actual)               Testie_AssertNumber64((TESTIE_UINT64) (Expected), (TESTIE_UINT64) (Actual), 0U)
 #define ASSERT_EQUAL_UINT(Expected, Actual)                 ASSERT_EQUAL_UINT32((Expected), (Actual))
 
 #define ASSERT_EQUAL_HEX(Expected, Actual)                  Testie_AssertNumber((Expected), (Actual), 1U)
+#define ASSERT_EQUAL_HEX64(Expected, Actual)                Testie_AssertNumber64((Expected), (Actual), 1U)
 
 #define ASSERT_EQUAL_MEMORY(Expected, Actual, Length)       Testie_AssertMemory((void *) (Expected), (Actual), (Length), 0U)
 #define ASSERT_EQUAL_MEMORY_ROM(Expected, Actual, Length)   Testie_AssertMemory((void *) (Expected), (Actual), (Length), 1U)
@@ -0,0 +1,320 @@
+/* Includes **************************************************************************************/
+
+#include "TestieFormat.h"
+
+#include TESTIE_OUTPUT_CHAR_INCLUDE
+
+
+/* Constants *************************************************************************************/
+
+#if (TESTIE_FORMAT_DIVISION_FREE == 1U)
+#define TESTIE_FORMAT_DECIMAL_POWER_32      1000000000UL
+
+// Eight, four, two and one times the powers of ten below the first decimal digit of a 32-bit
+// number, stored so small cores do not need multi-word shifts
+static TESTIE_ROM const TESTIE_UINT32 aui32TestieDecimalWeights[TESTIE_FORMAT_DECIMAL_DIGITS_32 - 1U][4] =
+{
+    { 800000000UL, 400000000UL, 200000000UL, 100000000UL },
+    {  80000000UL,  40000000UL,  20000000UL,  10000000UL },
+    {   8000000UL,   4000000UL,   2000000UL,   1000000UL },
+    {    800000UL,    400000UL,    200000UL,    100000UL },
+    {     80000UL,     40000UL,     20000UL,     10000UL },
+    {      8000UL,      4000UL,      2000UL,      1000UL },
+    {       800UL,       400UL,       200UL,       100UL },
+    {        80UL,        40UL,        20UL,        10UL },
+    {         8UL,         4UL,         2UL,         1UL }
+};
+#endif
+
+#if (TESTIE_64BIT_ENABLE == 1U)
+// Powers of ten for the decimal digits of a 64-bit number down to the first one below 2^32, used
+// in both modes because 32-bit cores need a library call for a 64-bit division
+static TESTIE_ROM const TESTIE_UINT64 aui64TestiePowersOfTen[TESTIE_FORMAT_DECIMAL_DIGITS_64 - TESTIE_FORMAT_DECIMAL_DIGITS_32 + 1U] =
+{
+    10000000000000000000ULL, 1000000000000000000ULL, 100000000000000000ULL, 10000000000000000ULL,
+    1000000000000000ULL, 100000000000000ULL, 10000000000000ULL, 1000000000000ULL, 100000000000ULL,
+    10000000000ULL, 1000000000ULL
+};
+#endif
+
+
+/* Private functions *****************************************************************************/
+
+/**************************************************************************************************
+* Desc  : Print the leading zeros for a width larger than the maximum amount of digits
+*
+* Input : ui8Width is the minimum amount of digits
+* Input : ui8Digits is the maximum amount of digits of the number
+**************************************************************************************************/
+void Testie_PrintPadding(TESTIE_UINT8 ui8Width, TESTIE_UINT8 ui8Digits)
+{
+    for (; ui8Width > ui8Digits; ui8Width--)
+        TESTIE_OUTPUT_CHAR(TESTIE_FORMAT_PAD_CHARACTER);
+}
+
+
+#if (TESTIE_FORMAT_DIVISION_FREE == 1U)
+/**************************************************************************************************
+* Desc  : Print up to ten decimal digits by subtracting eight, four, two and one times each power
+*         of ten, no division is used
+*
+* Input : ui32Number is a unsigned number
+* Input : ui8Width is the minimum amount of digits, at most ten are printed
+**************************************************************************************************/
+void Testie_PrintDecimal(TESTIE_UINT32 ui32Number, TESTIE_UINT8 ui8Width)
+{
+    TESTIE_ROM const TESTIE_UINT32 * pui32Weights;
+    TESTIE_UINT8 ui8Position;
+    TESTIE_CHAR cDigit;
+
+    // The first digit is at most four, eight times its power of ten does not fit in 32 bits
+    for (cDigit = '0'; ui32Number >= TESTIE_FORMAT_DECIMAL_POWER_32; cDigit++)
+        ui32Number -= TESTIE_FORMAT_DECIMAL_POWER_32;
+
+    for (ui8Position = TESTIE_FORMAT_DECIMAL_DIGITS_32; ui8Position > 1U; ui8Position--)
+    {
+        // Once a digit is printed all following digits are printed as well
+        if (cDigit != '0' || ui8Width >= ui8Position)
+        {
+            TESTIE_OUTPUT_CHAR(cDigit);
+            ui8Width = ui8Position - 1U;
+        }
+
+        // The next digit is found by subtracting eight, four, two and one times its power of ten
+        pui32Weights = aui32TestieDecimalWeights[TESTIE_FORMAT_DECIMAL_DIGITS_32 - ui8Position];
+        cDigit       = '0';
+
+        if (ui32Number >= pui32Weights[0])
+        {
+            ui32Number -= pui32Weights[0];
+            cDigit     += 8;
+        }
+        if (ui32Number >= pui32Weights[1])
+        {
+            ui32Number -= pui32Weights[1];
+            cDigit     += 4;
+        }
+        if (ui32Number >= pui32Weights[2])
+        {
+            ui32Number -= pui32Weights[2];
+            cDigit     += 2;
+        }
+        if (ui32Number >= pui32Weights[3])
+        {
+            ui32Number -= pui32Weights[3];
+            cDigit     += 1;
+        }
+    }
+
+    TESTIE_OUTPUT_CHAR(cDigit);
+}
+#else
+/**************************************************************************************************
+* Desc  : Print up to ten decimal digits, the division by a constant ten is turned into a
+*         multiplication by the compiler
+*
+* Input : ui32Number is a unsigned number
+* Input : ui8Width is the minimum amount of digits, at most ten are printed
+**************************************************************************************************/
+void Testie_PrintDecimal(TESTIE_UINT32 ui32Number, TESTIE_UINT8 ui8Width)
+{
+    TESTIE_CHAR acDigits[TESTIE_FORMAT_DECIMAL_DIGITS_32];
+    TESTIE_UINT8 ui8Length = 0U;
+
+    do
+    {
+        acDigits[ui8Length++] = '0' + (TESTIE_CHAR) (ui32Number % 10U);
+        ui32Number /= 10U;
+    } while (ui32Number != 0U);
+
+    if (ui8Width > TESTIE_FORMAT_DECIMAL_DIGITS_32)
+        ui8Width = TESTIE_FORMAT_DECIMAL_DIGITS_32;
+
+    for (; ui8Width > ui8Length; ui8Width--)
+        TESTIE_OUTPUT_CHAR(TESTIE_FORMAT_PAD_CHARACTER);
+
+    while (ui8Length != 0U)
+        TESTIE_OUTPUT_CHAR(acDigits[--ui8Length]);
+}
+#endif
+
+
+/**************************************************************************************************
+* Desc  : Print the hexadecimal digits of a number without suffix
+*
+* Input : ui32HexNumber is a hexadecimal value
+* Input : ui8LengthMin is the minimum character length, at most eight are printed
+**************************************************************************************************/
+void Testie_PrintHexDigits(TESTIE_UINT32 ui32HexNumber, TESTIE_UINT8 ui8LengthMin)
+{
+    TESTIE_UINT8 ui8Position;
+    TESTIE_UINT8 ui8Nibble;
+
+    // The number is shifted by a constant amount, variable shifts are slow on small cores
+    for (ui8Position = TESTIE_FORMAT_HEX_DIGITS_32; ui8Position != 0U; ui8Position--)
+    {
+        ui8Nibble = (TESTIE_UINT8) (ui32HexNumber >> 28) & 0x0FU;
+        ui32HexNumber <<= 4;
+
+        if (ui8Nibble != 0U || ui8LengthMin >= ui8Position)
+        {
+            Testie_PrintHexCharacter(ui8Nibble);
+            ui8LengthMin = ui8Position - 1U;
+        }
+    }
+}
+
+
+/* Public functions ******************************************************************************/
+
+/**************************************************************************************************
+* Desc  : Print a hexadecimal ASCII character
+*
+* Input : ui8HexValue is a hexadecimal value for the character
+**************************************************************************************************/
+void Testie_PrintHexCharacter(TESTIE_UINT8 ui8HexValue)
+{
+    if (ui8HexValue >= 0x0A)
+    {
+        TESTIE_OUTPUT_CHAR(0x37 + ui8HexValue);
+    }
+    else
+    {
+        TESTIE_OUTPUT_CHAR('0' + ui8HexValue);
+    }
+}
+
+
+/**************************************************************************************************
+* Desc  : Print a number, with TESTIE_FORMAT_DIVISION_FREE set the digits are found by subtracting
+*         powers of ten, else by a division by a constant ten
+*
+* Input : ui32Number is a unsigned number
+* Input : ui8Width is the minimum amount of digits, padded with leading zeros
+**************************************************************************************************/
+void Testie_PrintNumber(TESTIE_UINT32 ui32Number, TESTIE_UINT8 ui8Width)
+{
+    Testie_PrintPadding(ui8Width, TESTIE_FORMAT_DECIMAL_DIGITS_32);
+    Testie_PrintDecimal(ui32Number, ui8Width);
+}
+
+
+/**************************************************************************************************
+* Desc  : Print a number that can be negative, including the most negative value
+*
+* Input : i32Number is a signed number
+* Input : ui8Width is the minimum amount of digits, padded with leading zeros
+**************************************************************************************************/
+void Testie_PrintSignedNumber(TESTIE_INT32 i32Number, TESTIE_UINT8 ui8Width)
+{
+    TESTIE_UINT32 ui32Number = (TESTIE_UINT32) i32Number;
+
+    // Negate as unsigned so the most negative value does not overflow
+    if (i32Number < 0)
+    {
+        TESTIE_OUTPUT_CHAR('-');
+        ui32Number = 0U - ui32Number;
+    }
+    Testie_PrintNumber(ui32Number, ui8Width);
+}
+
+
+/**************************************************************************************************
+* Desc  : Print a hexadecimal number
+*
+* Input : ui32HexNumber is a hexadecimal value
+* Input : ui8LengthMin is the minimum character length of the hexadecimal value
+**************************************************************************************************/
+void Testie_PrintHexNumber(TESTIE_UINT32 ui32HexNumber, TESTIE_UINT8 ui8LengthMin)
+{
+    Testie_PrintPadding(ui8LengthMin, TESTIE_FORMAT_HEX_DIGITS_32);
+    Testie_PrintHexDigits(ui32HexNumber, ui8LengthMin);
+
+    TESTIE_OUTPUT_CHAR(TESTIE_FORMAT_HEX_SUFFIX);
+}
+
+
+#if (TESTIE_64BIT_ENABLE == 1U)
+/**************************************************************************************************
+* Desc  : Print a 64-bit number, the upper digits are found by subtracting powers of ten and the
+*         remaining nine digits are printed as in Testie_PrintNumber(), no 64-bit division is used
+*
+* Input : ui64Number is a unsigned number
+* Input : ui8Width is the minimum amount of digits, padded with leading zeros
+**************************************************************************************************/
+void Testie_PrintNumber64(TESTIE_UINT64 ui64Number, TESTIE_UINT8 ui8Width)
+{
+    TESTIE_UINT8 ui8Position;
+    TESTIE_UINT64 ui64Power;
+    TESTIE_CHAR cDigit;
+
+    if ((ui64Number >> 32) == 0U)
+    {
+        Testie_PrintNumber((TESTIE_UINT32) ui64Number, ui8Width);
+        return;
+    }
+
+    Testie_PrintPadding(ui8Width, TESTIE_FORMAT_DECIMAL_DIGITS_64);
+
+    // Only the upper digits need 64-bit subtractions, the remainder fits in 32 bits
+    for (ui8Position = TESTIE_FORMAT_DECIMAL_DIGITS_64; ui8Position >= TESTIE_FORMAT_DECIMAL_DIGITS_32; ui8Position--)
+    {
+        ui64Power = aui64TestiePowersOfTen[TESTIE_FORMAT_DECIMAL_DIGITS_64 - ui8Position];
+        for (cDigit = '0'; ui64Number >= ui64Power; cDigit++)
+            ui64Number -= ui64Power;
+
+        if (cDigit != '0' || ui8Width >= ui8Position)
+        {
+            TESTIE_OUTPUT_CHAR(cDigit);
+            ui8Width = ui8Position - 1U;
+        }
+    }
+
+    Testie_PrintDecimal((TESTIE_UINT32) ui64Number, ui8Width);
+}
+
+
+/**************************************************************************************************
+* Desc  : Print a 64-bit number that can be negative, including the most negative value
+*
+* Input : i64Number is a signed number
+* Input : ui8Width is the minimum amount of digits, padded with leading zeros
+**************************************************************************************************/
+void Testie_PrintSignedNumber64(TESTIE_INT64 i64Number, TESTIE_UINT8 ui8Width)
+{
+    TESTIE_UINT64 ui64Number = (TESTIE_UINT64) i64Number;
+
+    if (i64Number < 0)
+    {
+        TESTIE_OUTPUT_CHAR('-');
+        ui64Number = 0U - ui64Number;
+    }
+    Testie_PrintNumber64(ui64Number, ui8Width);
+}
+
+
+/**************************************************************************************************
+* Desc  : Print a 64-bit hexadecimal number
+*
+* Input : ui64HexNumber is a hexadecimal value
+* Input : ui8LengthMin is the minimum character length of the hexadecimal value
+**************************************************************************************************/
+void Testie_PrintHexNumber64(TESTIE_UINT64 ui64HexNumber, TESTIE_UINT8 ui8LengthMin)
+{
+    TESTIE_UINT32 ui32High = (TESTIE_UINT32) (ui64HexNumber >> 32);
+
+    Testie_PrintPadding(ui8LengthMin, TESTIE_FORMAT_HEX_DIGITS_64);
+
+    if (ui32High != 0U || ui8LengthMin > TESTIE_FORMAT_HEX_DIGITS_32)
+    {
+        Testie_PrintHexDigits(ui32High, (ui8LengthMin > TESTIE_FORMAT_HEX_DIGITS_32) ? ui8LengthMin - TESTIE_FORMAT_HEX_DIGITS_32 : 0U);
+        ui8LengthMin = TESTIE_FORMAT_HEX_DIGITS_32;
+    }
+    Testie_PrintHexDigits((TESTIE_UINT32) ui64HexNumber, ui8LengthMin);
+
+    TESTIE_OUTPUT_CHAR(TESTIE_FORMAT_HEX_SUFFIX);
+}
+#endif
+
+
+/* End of module *********************************************************************************/
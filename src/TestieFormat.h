@@ -0,0 +1,90 @@
+#ifndef _TESTIE_FORMAT_
+#define _TESTIE_FORMAT_
+
+/* Includes **************************************************************************************/
+
+#include "TestieInternals.h"
+
+
+/* Constants *************************************************************************************/
+
+#define TESTIE_FORMAT_DECIMAL_DIGITS_32     10U
+#define TESTIE_FORMAT_DECIMAL_DIGITS_64     20U
+
+#define TESTIE_FORMAT_HEX_DIGITS_32         8U
+#define TESTIE_FORMAT_HEX_DIGITS_64         16U
+
+#define TESTIE_FORMAT_HEX_SUFFIX            'h'
+#define TESTIE_FORMAT_PAD_CHARACTER         '0'
+
+
+/* Public functions ******************************************************************************/
+
+/**************************************************************************************************
+* Desc  : Print a hexadecimal ASCII character
+*
+* Input : ui8HexValue is a hexadecimal value for the character
+**************************************************************************************************/
+void Testie_PrintHexCharacter(TESTIE_UINT8 ui8HexValue);
+
+
+/**************************************************************************************************
+* Desc  : Print a number, with TESTIE_FORMAT_DIVISION_FREE set the digits are found by subtracting
+*         powers of ten, else by a division by a constant ten
+*
+* Input : ui32Number is a unsigned number
+* Input : ui8Width is the minimum amount of digits, padded with leading zeros
+**************************************************************************************************/
+void Testie_PrintNumber(TESTIE_UINT32 ui32Number, TESTIE_UINT8 ui8Width);
+
+
+/**************************************************************************************************
+* Desc  : Print a number that can be negative, including the most negative value
+*
+* Input : i32Number is a signed number
+* Input : ui8Width is the minimum amount of digits, padded with leading zeros
+**************************************************************************************************/
+void Testie_PrintSignedNumber(TESTIE_INT32 i32Number, TESTIE_UINT8 ui8Width);
+
+
+/**************************************************************************************************
+* Desc  : Print a hexadecimal number
+*
+* Input : ui32HexNumber is a hexadecimal value
+* Input : ui8LengthMin is the minimum character length of the hexadecimal value
+**************************************************************************************************/
+void Testie_PrintHexNumber(TESTIE_UINT32 ui32HexNumber, TESTIE_UINT8 ui8LengthMin);
+
+
+#if (TESTIE_64BIT_ENABLE == 1U)
+/**************************************************************************************************
+* Desc  : Print a 64-bit number, the upper digits are found by subtracting powers of ten and the
+*         remaining nine digits are printed as in Testie_PrintNumber(), no 64-bit division is used
+*
+* Input : ui64Number is a unsigned number
+* Input : ui8Width is the minimum amount of digits, padded with leading zeros
+**************************************************************************************************/
+void Testie_PrintNumber64(TESTIE_UINT64 ui64Number, TESTIE_UINT8 ui8Width);
+
+
+/**************************************************************************************************
+* Desc  : Print a 64-bit number that can be negative, including the most negative value
+*
+* Input : i64Number is a signed number
+* Input : ui8Width is the minimum amount of digits, padded with leading zeros
+**************************************************************************************************/
+void Testie_PrintSignedNumber64(TESTIE_INT64 i64Number, TESTIE_UINT8 ui8Width);
+
+
+/**************************************************************************************************
+* Desc  : Print a 64-bit hexadecimal number
+*
+* Input : ui64HexNumber is a hexadecimal value
+* Input : ui8LengthMin is the minimum character length of the hexadecimal value
+**************************************************************************************************/
+void Testie_PrintHexNumber64(TESTIE_UINT64 ui64HexNumber, TESTIE_UINT8 ui8LengthMin);
+#endif
+
+
+/* End of module *********************************************************************************/
+#endif
@@ -15,6 +15,15 @@
 #define TESTIE_INTEGER_VARIABLE_WIDTH       32U
 #endif
 
+// 64-bit numbers are opt-in on 16-bit cores, where they pull in large library helpers
+#if !defined(TESTIE_64BIT_ENABLE)
+#if (TESTIE_INTEGER_VARIABLE_WIDTH == 32U)
+#define TESTIE_64BIT_ENABLE                 1U
+#else
+#define TESTIE_64BIT_ENABLE                 0U
+#endif
+#endif
+
 // General declaration settings
 #if !defined(TESTIE_ROM)
 #define TESTIE_ROM
@@ -54,6 +63,62 @@
 #define TESTIE_OUTPUT_CHAR                  putchar
 #endif
 
+// Formatting settings, 32-bit numbers are converted without division on cores without a hardware
+// divider (e.g. 16-bit cores or Cortex-M0), elsewhere a division by ten is cheaper. The upper
+// digits of 64-bit numbers are always found by subtraction.
+#if !defined(TESTIE_FORMAT_DIVISION_FREE)
+#if (TESTIE_INTEGER_VARIABLE_WIDTH == 16U)
+#define TESTIE_FORMAT_DIVISION_FREE         1U
+#else
+#define TESTIE_FORMAT_DIVISION_FREE         0U
+#endif
+#endif
+
+// Timeout settings, a time budget of 0 disables the timeout
+#if !defined(TESTIE_TIMEOUT_ENABLE)
+#if defined(__linux__)
+#define TESTIE_TIMEOUT_ENABLE               1U
+#else
+#define TESTIE_TIMEOUT_ENABLE               0U
+#endif
+#endif
+
+#if !defined(TESTIE_TIMEOUT_CASE_DEFAULT)
+#define TESTIE_TIMEOUT_CASE_DEFAULT         0U
+#endif
+
+#if !defined(TESTIE_TIMEOUT_SUITE_DEFAULT)
+#define TESTIE_TIMEOUT_SUITE_DEFAULT        0U
+#endif
+
+// Watchdog functions, the watchdog has to call Testie_Timeout() when the time budget expires.
+// Testie_Timeout() leaves the test case with longjmp, which is valid from a POSIX signal handler
+// but not from an interrupt with a hardware exception frame (e.g. Cortex-M). Such ports define
+// TESTIE_WATCHDOG_RECOVER(Resume), which makes the running interrupt return into Resume instead
+// of its interrupted code (e.g. by replacing the stacked return address). The interrupt handler
+// then has to return normally after calling Testie_Timeout().
+#if (TESTIE_TIMEOUT_ENABLE == 1U)
+#if !defined(TESTIE_WATCHDOG_START) && defined(__linux__)
+#define TESTIE_WATCHDOG_POSIX
+#define TESTIE_WATCHDOG_START               Testie_PosixWatchdogStart
+#define TESTIE_WATCHDOG_STOP                Testie_PosixWatchdogStop
+#define TESTIE_WATCHDOG_RELEASE             Testie_PosixWatchdogRelease
+#endif
+
+// Optional, called at the end of every test suite to release the watchdog resources
+#if !defined(TESTIE_WATCHDOG_RELEASE)
+#define TESTIE_WATCHDOG_RELEASE()
+#endif
+
+#if !defined(TESTIE_TIME_MS) && defined(__linux__)
+#define TESTIE_TIME_MS                      Testie_PosixTimeMs
+#endif
+
+#if !defined(TESTIE_WATCHDOG_START) || !defined(TESTIE_WATCHDOG_STOP) || !defined(TESTIE_TIME_MS)
+#error TESTIE_TIMEOUT_ENABLE requires TESTIE_WATCHDOG_START, TESTIE_WATCHDOG_STOP and TESTIE_TIME_MS.
+#endif
+#endif
+
 
 /* Type definitions ******************************************************************************/
 
@@ -78,6 +143,11 @@ typedef unsigned int                        TESTIE_UINT32;
 #error TESTIE_INTEGER_VARIABLE_WIDTH is not a valid value (16 or 32).
 #endif
 
+#if (TESTIE_64BIT_ENABLE == 1U)
+typedef signed   long long                  TESTIE_INT64;
+typedef unsigned long long                  TESTIE_UINT64;
+#endif
+
 // Testie variable structure
 typedef struct
 {
@@ -89,7 +159,13 @@ typedef struct
         TESTIE_UINT8 CountFailed;
         void (*Setup)(void);
         void (*TearDown)(void);
+        TESTIE_UINT32 Timeout;
     } Case;
+    struct
+    {
+        TESTIE_UINT32 Timeout;
+        TESTIE_UINT32 Start;
+    } Suite;
 } S_TESTIE;
 
 
@@ -114,6 +190,10 @@ typedef struct
 
 #define TESTIE_OUTPUT_ASSERT_FAIL           " - Assertion set to fail"TESTIE_OUTPUT_END_LINE
 
+#define TESTIE_OUTPUT_CASE_TIMEOUT          " - Timeout after "
+#define TESTIE_OUTPUT_SUITE_TIMEOUT         " - Test suite timeout after "
+#define TESTIE_OUTPUT_MILLISECONDS          " ms"TESTIE_OUTPUT_END_LINE
+
 
 /* Global variables ******************************************************************************/
 
@@ -168,6 +248,27 @@ void Testie_AssertNumber(TESTIE_UINT32 ui32Expected, TESTIE_UINT32 ui32Actual, T
 void Testie_AssertSignedNumber(TESTIE_INT32 i32Expected, TESTIE_INT32 i32Actual);
 
 
+#if (TESTIE_64BIT_ENABLE == 1U)
+/**************************************************************************************************
+* Desc  : Test if two 64-bit numbers are equal
+*
+* Input : ui64Expected is the expected number
+* Input : ui64Actual is the actual number
+* Input : ui8IsHex is 1 if expected and actual are hexadecimal else 0
+**************************************************************************************************/
+void Testie_AssertNumber64(TESTIE_UINT64 ui64Expected, TESTIE_UINT64 ui64Actual, TESTIE_UINT8 ui8IsHex);
+
+
+/**************************************************************************************************
+* Desc  : Test if two signed 64-bit numbers are equal
+*
+* Input : i64Expected is the expected number
+* Input : i64Actual is the actual number
+**************************************************************************************************/
+void Testie_AssertSignedNumber64(TESTIE_INT64 i64Expected, TESTIE_INT64 i64Actual);
+#endif
+
+
 /**************************************************************************************************
 * Desc  : Test if two strings are equal
 *
@@ -188,5 +289,54 @@ void Testie_AssertString(void * pExpected, TESTIE_CHAR * pcActual, TESTIE_UINT8
 void Testie_AssertMemory(void * pExpected, TESTIE_UINT8 * pui8Actual, TESTIE_UINT8 ui8Length, TESTIE_UINT8 ui8IsExpectedROM);
 
 
+#if (TESTIE_TIMEOUT_ENABLE == 1U)
+/**************************************************************************************************
+* Desc  : Abort the running test case when its time budget expired, called by the watchdog
+*         interrupt or signal handler. Without TESTIE_WATCHDOG_RECOVER this function does not
+*         return, so it may only be called where longjmp out of the handler is valid.
+**************************************************************************************************/
+void Testie_Timeout(void);
+
+
+/**************************************************************************************************
+* Desc  : Resume point for TESTIE_WATCHDOG_RECOVER, jumps back to the test case runner once the
+*         watchdog interrupt has returned
+**************************************************************************************************/
+void Testie_TimeoutRecover(void);
+
+
+#if defined(__linux__)
+/**************************************************************************************************
+* Desc  : Read the monotonic clock
+*
+* Output: Returns the time in milliseconds
+**************************************************************************************************/
+TESTIE_UINT32 Testie_PosixTimeMs(void);
+#endif
+
+
+#if defined(TESTIE_WATCHDOG_POSIX)
+/**************************************************************************************************
+* Desc  : Arm the watchdog timer, the signal handler is installed once for each test suite
+*
+* Input : ui32Milliseconds is the time budget
+**************************************************************************************************/
+void Testie_PosixWatchdogStart(TESTIE_UINT32 ui32Milliseconds);
+
+
+/**************************************************************************************************
+* Desc  : Disarm the watchdog timer, so no signal reaches the tear down or later test cases
+**************************************************************************************************/
+void Testie_PosixWatchdogStop(void);
+
+
+/**************************************************************************************************
+* Desc  : Stop the timer and restore the signal handler that was installed before the test suite
+**************************************************************************************************/
+void Testie_PosixWatchdogRelease(void);
+#endif
+#endif
+
+
 /* End of module *********************************************************************************/
 #endif
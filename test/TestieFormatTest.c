@@ -0,0 +1,328 @@
+/* Includes **************************************************************************************/
+
+#include "Testie.h"
+#include "TestieFormat.h"
+
+#include <stdio.h>
+#include <string.h>
+
+
+/* Constants *************************************************************************************/
+
+#define FORMAT_TEST_CAPTURE_SIZE            64U
+#define FORMAT_TEST_RANDOM_ITERATIONS       200000UL
+#define FORMAT_TEST_RANDOM_WIDTH_MAX        24U
+
+
+/* Global variables ******************************************************************************/
+
+static TESTIE_CHAR acCapture[FORMAT_TEST_CAPTURE_SIZE];
+static TESTIE_UINT8 ui8CaptureLength;
+static TESTIE_UINT8 ui8Capturing;
+
+static unsigned long long ullRandomState = 0x0123456789ABCDEFULL;
+
+
+/* Private functions *****************************************************************************/
+
+/**************************************************************************************************
+* Desc  : Start capturing the output
+**************************************************************************************************/
+static void Capture_Start(void)
+{
+    ui8CaptureLength = 0U;
+    ui8Capturing     = 1U;
+}
+
+
+/**************************************************************************************************
+* Desc  : Stop capturing the output
+*
+* Output: Returns the captured output as string
+**************************************************************************************************/
+static TESTIE_CHAR * Capture_Stop(void)
+{
+    ui8Capturing                = 0U;
+    acCapture[ui8CaptureLength] = '\0';
+
+    return acCapture;
+}
+
+
+/**************************************************************************************************
+* Desc  : Format helpers returning the captured output of a formatting function
+**************************************************************************************************/
+static TESTIE_CHAR * Capture_Number(TESTIE_UINT32 ui32Number, TESTIE_UINT8 ui8Width)
+{
+    Capture_Start();
+    Testie_PrintNumber(ui32Number, ui8Width);
+    return Capture_Stop();
+}
+
+
+static TESTIE_CHAR * Capture_SignedNumber(TESTIE_INT32 i32Number, TESTIE_UINT8 ui8Width)
+{
+    Capture_Start();
+    Testie_PrintSignedNumber(i32Number, ui8Width);
+    return Capture_Stop();
+}
+
+
+static TESTIE_CHAR * Capture_HexNumber(TESTIE_UINT32 ui32HexNumber, TESTIE_UINT8 ui8LengthMin)
+{
+    Capture_Start();
+    Testie_PrintHexNumber(ui32HexNumber, ui8LengthMin);
+    return Capture_Stop();
+}
+
+
+#if (TESTIE_64BIT_ENABLE == 1U)
+static TESTIE_CHAR * Capture_Number64(TESTIE_UINT64 ui64Number, TESTIE_UINT8 ui8Width)
+{
+    Capture_Start();
+    Testie_PrintNumber64(ui64Number, ui8Width);
+    return Capture_Stop();
+}
+
+
+static TESTIE_CHAR * Capture_SignedNumber64(TESTIE_INT64 i64Number, TESTIE_UINT8 ui8Width)
+{
+    Capture_Start();
+    Testie_PrintSignedNumber64(i64Number, ui8Width);
+    return Capture_Stop();
+}
+
+
+static TESTIE_CHAR * Capture_HexNumber64(TESTIE_UINT64 ui64HexNumber, TESTIE_UINT8 ui8LengthMin)
+{
+    Capture_Start();
+    Testie_PrintHexNumber64(ui64HexNumber, ui8LengthMin);
+    return Capture_Stop();
+}
+#endif
+
+
+/**************************************************************************************************
+* Desc  : Deterministic pseudo random number with a random amount of significant bits
+*
+* Output: Returns the random number
+**************************************************************************************************/
+static unsigned long long Random_Next(void)
+{
+    ullRandomState ^= ullRandomState << 13;
+    ullRandomState ^= ullRandomState >> 7;
+    ullRandomState ^= ullRandomState << 17;
+
+    return ullRandomState >> (ullRandomState & 0x3FU);
+}
+
+
+/**************************************************************************************************
+* Desc  : Compare a formatted number with the expected string, a mismatch is reported right away
+*         as failing assertion with both strings. Matches are not asserted, the pass counter of a
+*         test case would overflow.
+*
+* Input : pcExpected is the expected string
+* Input : pcActual is the formatted string
+* Output: Returns 1 on a mismatch else 0
+**************************************************************************************************/
+static TESTIE_UINT8 Format_Compare(TESTIE_CHAR * pcExpected, TESTIE_CHAR * pcActual)
+{
+    if (strcmp(pcExpected, pcActual) == 0)
+        return 0U;
+
+    ASSERT_EQUAL_STRING(pcExpected, pcActual);
+    return 1U;
+}
+
+
+/**************************************************************************************************
+* Desc  : Empty setup and tear down
+**************************************************************************************************/
+static void Format_Empty(void)
+{
+}
+
+
+/* Test cases ************************************************************************************/
+
+TEST(Format_Number)
+{
+    ASSERT_EQUAL_STRING("0", Capture_Number(0U, 0U));
+    ASSERT_EQUAL_STRING("0", Capture_Number(0U, 1U));
+    ASSERT_EQUAL_STRING("9", Capture_Number(9U, 0U));
+    ASSERT_EQUAL_STRING("10", Capture_Number(10U, 0U));
+    ASSERT_EQUAL_STRING("00042", Capture_Number(42U, 5U));
+    ASSERT_EQUAL_STRING("999999999", Capture_Number(999999999UL, 0U));
+    ASSERT_EQUAL_STRING("1000000000", Capture_Number(1000000000UL, 0U));
+    ASSERT_EQUAL_STRING("4294967295", Capture_Number(4294967295UL, 0U));
+    ASSERT_EQUAL_STRING("4294967295", Capture_Number(4294967295UL, 4U));
+    ASSERT_EQUAL_STRING("0000000000", Capture_Number(0U, 10U));
+    ASSERT_EQUAL_STRING("000000000007", Capture_Number(7U, 12U));
+    ASSERT_EQUAL_STRING("004294967295", Capture_Number(4294967295UL, 12U));
+}
+
+
+TEST(Format_SignedNumber)
+{
+    ASSERT_EQUAL_STRING("0", Capture_SignedNumber(0, 0U));
+    ASSERT_EQUAL_STRING("-1", Capture_SignedNumber(-1, 0U));
+    ASSERT_EQUAL_STRING("-005", Capture_SignedNumber(-5, 3U));
+    ASSERT_EQUAL_STRING("2147483647", Capture_SignedNumber(2147483647L, 0U));
+    ASSERT_EQUAL_STRING("-2147483648", Capture_SignedNumber(-2147483647L - 1L, 0U));
+    ASSERT_EQUAL_STRING("-002147483648", Capture_SignedNumber(-2147483647L - 1L, 12U));
+}
+
+
+TEST(Format_HexNumber)
+{
+    ASSERT_EQUAL_STRING("h", Capture_HexNumber(0U, 0U));
+    ASSERT_EQUAL_STRING("0h", Capture_HexNumber(0U, 1U));
+    ASSERT_EQUAL_STRING("0Ah", Capture_HexNumber(0x0AU, 2U));
+    ASSERT_EQUAL_STRING("ABh", Capture_HexNumber(0xABU, 1U));
+    ASSERT_EQUAL_STRING("DEADBEEFh", Capture_HexNumber(0xDEADBEEFUL, 1U));
+    ASSERT_EQUAL_STRING("0000BEEFh", Capture_HexNumber(0xBEEFU, 8U));
+    ASSERT_EQUAL_STRING("000000000Ah", Capture_HexNumber(0x0AU, 10U));
+    ASSERT_EQUAL_STRING("00FFFFFFFFh", Capture_HexNumber(0xFFFFFFFFUL, 10U));
+}
+
+
+#if (TESTIE_64BIT_ENABLE == 1U)
+TEST(Format_Number64)
+{
+    ASSERT_EQUAL_STRING("0", Capture_Number64(0U, 0U));
+    ASSERT_EQUAL_STRING("4294967295", Capture_Number64(4294967295ULL, 0U));
+    ASSERT_EQUAL_STRING("4294967296", Capture_Number64(4294967296ULL, 0U));
+    ASSERT_EQUAL_STRING("9999999999", Capture_Number64(9999999999ULL, 0U));
+    ASSERT_EQUAL_STRING("10000000000", Capture_Number64(10000000000ULL, 0U));
+    ASSERT_EQUAL_STRING("1000000000000000000", Capture_Number64(1000000000000000000ULL, 0U));
+    ASSERT_EQUAL_STRING("10000000000000000000", Capture_Number64(10000000000000000000ULL, 0U));
+    ASSERT_EQUAL_STRING("18446744073709551615", Capture_Number64(18446744073709551615ULL, 0U));
+    ASSERT_EQUAL_STRING("000000000004294967296", Capture_Number64(4294967296ULL, 21U));
+    ASSERT_EQUAL_STRING("0000000000000000000001", Capture_Number64(1U, 22U));
+    ASSERT_EQUAL_STRING("0018446744073709551615", Capture_Number64(18446744073709551615ULL, 22U));
+}
+
+
+TEST(Format_SignedNumber64)
+{
+    ASSERT_EQUAL_STRING("-1", Capture_SignedNumber64(-1, 0U));
+    ASSERT_EQUAL_STRING("-2147483648", Capture_SignedNumber64(-2147483648LL, 0U));
+    ASSERT_EQUAL_STRING("-4294967296", Capture_SignedNumber64(-4294967296LL, 0U));
+    ASSERT_EQUAL_STRING("9223372036854775807", Capture_SignedNumber64(9223372036854775807LL, 0U));
+    ASSERT_EQUAL_STRING("-9223372036854775808", Capture_SignedNumber64(-9223372036854775807LL - 1LL, 0U));
+    ASSERT_EQUAL_STRING("-009223372036854775808", Capture_SignedNumber64(-9223372036854775807LL - 1LL, 21U));
+}
+
+
+TEST(Format_HexNumber64)
+{
+    ASSERT_EQUAL_STRING("h", Capture_HexNumber64(0U, 0U));
+    ASSERT_EQUAL_STRING("FFFFFFFFh", Capture_HexNumber64(0xFFFFFFFFULL, 1U));
+    ASSERT_EQUAL_STRING("100000000h", Capture_HexNumber64(0x100000000ULL, 1U));
+    ASSERT_EQUAL_STRING("FFFFFFFFFFFFFFFFh", Capture_HexNumber64(0xFFFFFFFFFFFFFFFFULL, 1U));
+    ASSERT_EQUAL_STRING("000000000000000001h", Capture_HexNumber64(1U, 18U));
+    ASSERT_EQUAL_STRING("00ABCDEF00000000h", Capture_HexNumber64(0xABCDEF00000000ULL, 16U));
+    ASSERT_EQUAL_STRING("0000000123456789h", Capture_HexNumber64(0x123456789ULL, 16U));
+}
+#endif
+
+
+TEST(Format_RandomAgainstPrintf)
+{
+    char acExpected[FORMAT_TEST_CAPTURE_SIZE];
+    unsigned long ulIndex;
+    unsigned long ulMismatches = 0UL;
+
+    for (ulIndex = 0UL; ulIndex < FORMAT_TEST_RANDOM_ITERATIONS && ulMismatches == 0UL; ulIndex++)
+    {
+        unsigned long long ullValue = Random_Next();
+        unsigned int uiWidth        = (unsigned int) (Random_Next() % FORMAT_TEST_RANDOM_WIDTH_MAX);
+        unsigned long ulValue       = (unsigned long) (ullValue & 0xFFFFFFFFUL);
+        long lValue                 = (ulValue > 0x7FFFFFFFUL) ? -(long) (0xFFFFFFFFUL - ulValue) - 1L : (long) ulValue;
+
+        snprintf(acExpected, sizeof(acExpected), "%0*lu", uiWidth, ulValue);
+        ulMismatches += Format_Compare(acExpected, Capture_Number((TESTIE_UINT32) ulValue, (TESTIE_UINT8) uiWidth));
+
+        if (lValue < 0L)
+            snprintf(acExpected, sizeof(acExpected), "-%0*lu", uiWidth, 0UL - (unsigned long) lValue);
+        else
+            snprintf(acExpected, sizeof(acExpected), "%0*ld", uiWidth, lValue);
+        ulMismatches += Format_Compare(acExpected, Capture_SignedNumber((TESTIE_INT32) lValue, (TESTIE_UINT8) uiWidth));
+
+        snprintf(acExpected, sizeof(acExpected), (uiWidth == 0U && ulValue == 0UL) ? "h" : "%0*lXh", uiWidth, ulValue);
+        ulMismatches += Format_Compare(acExpected, Capture_HexNumber((TESTIE_UINT32) ulValue, (TESTIE_UINT8) uiWidth));
+
+#if (TESTIE_64BIT_ENABLE == 1U)
+        snprintf(acExpected, sizeof(acExpected), "%0*llu", uiWidth, ullValue);
+        ulMismatches += Format_Compare(acExpected, Capture_Number64(ullValue, (TESTIE_UINT8) uiWidth));
+
+        if ((long long) ullValue < 0LL)
+            snprintf(acExpected, sizeof(acExpected), "-%0*llu", uiWidth, 0ULL - ullValue);
+        else
+            snprintf(acExpected, sizeof(acExpected), "%0*llu", uiWidth, ullValue);
+        ulMismatches += Format_Compare(acExpected, Capture_SignedNumber64((TESTIE_INT64) ullValue, (TESTIE_UINT8) uiWidth));
+
+        snprintf(acExpected, sizeof(acExpected), (uiWidth == 0U && ullValue == 0ULL) ? "h" : "%0*llXh", uiWidth, ullValue);
+        ulMismatches += Format_Compare(acExpected, Capture_HexNumber64(ullValue, (TESTIE_UINT8) uiWidth));
+#endif
+    }
+
+    ASSERT_EQUAL_UINT32(0U, ulMismatches);
+}
+
+
+/* Test suites ***********************************************************************************/
+
+TEST_SUITE(Format_Suite)
+{
+    Testie.Case.Setup    = Format_Empty;
+    Testie.Case.TearDown = Format_Empty;
+
+    TEST_RUN(Format_Number);
+    TEST_RUN(Format_SignedNumber);
+    TEST_RUN(Format_HexNumber);
+#if (TESTIE_64BIT_ENABLE == 1U)
+    TEST_RUN(Format_Number64);
+    TEST_RUN(Format_SignedNumber64);
+    TEST_RUN(Format_HexNumber64);
+#endif
+    TEST_RUN(Format_RandomAgainstPrintf);
+}
+
+
+/* Public functions ******************************************************************************/
+
+/**************************************************************************************************
+* Desc  : Output sink used by Testie, captures characters while a capture is running and prints
+*         them otherwise
+*
+* Input : iCharacter is the character Testie wants to output
+**************************************************************************************************/
+void TestieFormatTest_OutputChar(int iCharacter)
+{
+    if (ui8Capturing == 0U)
+    {
+        putchar(iCharacter);
+    }
+    else if (ui8CaptureLength < FORMAT_TEST_CAPTURE_SIZE - 1U)
+    {
+        acCapture[ui8CaptureLength++] = (TESTIE_CHAR) iCharacter;
+    }
+}
+
+
+/**************************************************************************************************
+* Desc  : Run the formatting self-test
+*
+* Output: Returns 0 when all test cases passed else 1
+**************************************************************************************************/
+int main(void)
+{
+    TEST_SUITE_RUN(Format_Suite);
+
+    return (Testie.Case.CountFailed == 0U) ? 0 : 1;
+}
+
+
+/* End of module *********************************************************************************/
@@ -0,0 +1,23 @@
+#ifndef _TESTIE_FORMAT_TEST_CONFIG_
+#define _TESTIE_FORMAT_TEST_CONFIG_
+
+/* Output settings *******************************************************************************/
+
+// Route every output character through a sink that can capture the formatted numbers
+#define TESTIE_OUTPUT_CHAR_INCLUDE          "TestieFormatTestConfig.h"
+#define TESTIE_OUTPUT_CHAR                  TestieFormatTest_OutputChar
+
+
+/* Public functions ******************************************************************************/
+
+/**************************************************************************************************
+* Desc  : Output sink used by Testie, captures characters while a capture is running and prints
+*         them otherwise
+*
+* Input : iCharacter is the character Testie wants to output
+**************************************************************************************************/
+void TestieFormatTest_OutputChar(int iCharacter);
+
+
+/* End of module *********************************************************************************/
+#endif